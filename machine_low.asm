@@ -15,4 +15,17 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; rdtsc()
+;
+; Returns the time-stamp counter, i.e. the number of cycles since reset,
+; in edx:eax.
+;
+; ----------------------------------------------------------------------
+global _rdtsc
+; this function is exported.
+_rdtsc:
+	rdtsc
+	ret